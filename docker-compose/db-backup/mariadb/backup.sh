@@ -0,0 +1,41 @@
+#!/bin/bash
+# Streams a full backup every BACKUP_FULL_EVERY runs and incremental backups in between,
+# compressed with zstd and uploaded to S3 without a local copy.
+set -eo pipefail
+
+mc alias set s3 "$S3_ENDPOINT" "$S3_ACCESS_KEY" "$S3_SECRET_KEY" > /dev/null
+run=0
+
+while true; do
+  name=$(date -u +%Y%m%dT%H%M%SZ)
+  args=()
+  # Current mariabackup names the checkpoint file "mariadb_backup_checkpoints", older versions "xtrabackup_checkpoints"
+  if [ $((run % ${BACKUP_FULL_EVERY:-7})) -eq 0 ] \
+    || { [ ! -f /state/lsn/mariadb_backup_checkpoints ] && [ ! -f /state/lsn/xtrabackup_checkpoints ]; }; then
+    name="$name-full"
+  else
+    name="$name-inc"
+    args=(--incremental-basedir=/state/lsn)
+  fi
+
+  start=$(date +%s)
+  rm -rf /state/lsn.new
+  # --extra-lsndir keeps the checkpoint locally for the next incremental backup.
+  # mc uploads whatever it received when mariabackup fails, remove the truncated object.
+  if ! mariabackup --backup --stream=xbstream --parallel="${BACKUP_PARALLEL:-4}" \
+    --host="$MARIADB_HOST" --user=root --password="$MARIADB_ROOT_PASSWORD" \
+    --target-dir=/tmp/backup --extra-lsndir=/state/lsn.new "${args[@]}" \
+    | zstd -T0 -"${BACKUP_ZSTD_LEVEL:-3}" \
+    | mc pipe "s3/$S3_BUCKET/$name.xbstream.zst"; then
+    echo "Backup $name failed" >&2
+    mc rm "s3/$S3_BUCKET/$name.xbstream.zst" > /dev/null 2>&1 || true
+    rm -rf /state/lsn.new
+    exit 1
+  fi
+  # Only replace the checkpoint after the whole backup is uploaded
+  rm -rf /state/lsn && mv /state/lsn.new /state/lsn
+  echo "Backup $name finished in $(( $(date +%s) - start ))s"
+
+  run=$((run + 1))
+  sleep "${BACKUP_INTERVAL:-86400}"
+done
@@ -0,0 +1,31 @@
+#!/bin/bash
+# Measures mariabackup backup and restore throughput of the running MariaDB server.
+# Backups go to the "benchmark/" prefix of S3_BUCKET, which is deleted afterwards.
+set -eo pipefail
+
+mc alias set s3 "$S3_ENDPOINT" "$S3_ACCESS_KEY" "$S3_SECRET_KEY" > /dev/null
+target="s3/$S3_BUCKET/benchmark/full.xbstream.zst"
+trap 'mc rm --recursive --force "s3/$S3_BUCKET/benchmark/" > /dev/null 2>&1 || true; rm -rf /tmp/restore' EXIT
+
+size_mb=$(( $(du -sk /var/lib/mysql | cut -f1) / 1024 ))
+echo "Data directory: ${size_mb}MB"
+
+start=$(date +%s)
+mariabackup --backup --stream=xbstream --parallel="${BACKUP_PARALLEL:-4}" \
+  --host="$MARIADB_HOST" --user=root --password="$MARIADB_ROOT_PASSWORD" \
+  --target-dir=/tmp/backup 2> /dev/null \
+  | zstd -T0 -"${BACKUP_ZSTD_LEVEL:-3}" \
+  | mc pipe "$target" > /dev/null
+seconds=$(( $(date +%s) - start )); [ "$seconds" -gt 0 ] || seconds=1
+echo "Full backup: ${seconds}s, $((size_mb / seconds)) MB/s"
+
+start=$(date +%s)
+mkdir -p /tmp/restore
+mc cat "$target" | zstd -d -T0 | mbstream -x -C /tmp/restore --parallel="${BACKUP_PARALLEL:-4}"
+seconds=$(( $(date +%s) - start )); [ "$seconds" -gt 0 ] || seconds=1
+echo "Restore (fetch): ${seconds}s, $((size_mb / seconds)) MB/s"
+
+start=$(date +%s)
+mariabackup --prepare --target-dir=/tmp/restore 2> /dev/null
+seconds=$(( $(date +%s) - start )); [ "$seconds" -gt 0 ] || seconds=1
+echo "Restore (prepare): ${seconds}s"
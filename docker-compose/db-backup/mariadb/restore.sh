@@ -0,0 +1,31 @@
+#!/bin/bash
+# Restores the latest full backup and all following incremental backups into an
+# empty data directory (/var/lib/mysql). Stop MariaDB before running it.
+set -eo pipefail
+
+mc alias set s3 "$S3_ENDPOINT" "$S3_ACCESS_KEY" "$S3_SECRET_KEY" > /dev/null
+backups=$(mc ls --json "s3/$S3_BUCKET" | { grep -o '"key":"[^"]*\.xbstream\.zst"' || true; } | cut -d'"' -f4 | sort)
+full=$(echo "$backups" | { grep -- '-full' || true; } | tail -n 1)
+if [ -z "$full" ]; then
+  echo "No full backup found in s3/$S3_BUCKET" >&2
+  exit 1
+fi
+incrementals=$(echo "$backups" | awk -v full="$full" '$0 > full && /-inc/')
+
+fetch() {
+  mkdir -p "/restore/$1"
+  mc cat "s3/$S3_BUCKET/$1" | zstd -d -T0 | mbstream -x -C "/restore/$1" --parallel="${BACKUP_PARALLEL:-4}"
+}
+
+start=$(date +%s)
+fetch "$full"
+mariabackup --prepare --target-dir="/restore/$full"
+for inc in $incrementals; do
+  fetch "$inc"
+  mariabackup --prepare --target-dir="/restore/$full" --incremental-dir="/restore/$inc"
+done
+mariabackup --copy-back --parallel="${BACKUP_PARALLEL:-4}" --target-dir="/restore/$full"
+chown -R mysql:mysql /var/lib/mysql
+echo "Restored $full and $(echo "$incrementals" | grep -c . || true) incremental backups in $(( $(date +%s) - start ))s"
+# Binary log position for point-in-time recovery with mariadb-binlog
+cat "/restore/$full/mariadb_backup_binlog_info" 2>/dev/null || true
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Pushes a base backup every BACKUP_INTERVAL seconds, WAL-G creates delta backups
+# until WALG_DELTA_MAX_STEPS is reached, then a new full backup.
+set -e
+export PGPASSWORD=$(cat "$POSTGRES_PASSWORD_FILE")
+
+while true; do
+  start=$(date +%s)
+  wal-g backup-push "$PGDATA"
+  echo "Backup finished in $(( $(date +%s) - start ))s"
+
+  # Retention, keeps the last BACKUP_RETAIN_FULL full backups and their deltas and WAL
+  wal-g delete retain FULL "${BACKUP_RETAIN_FULL:-7}" --confirm
+  sleep "${BACKUP_INTERVAL:-86400}"
+done
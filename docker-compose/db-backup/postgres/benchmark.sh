@@ -0,0 +1,34 @@
+#!/bin/bash
+# Measures WAL-G backup and restore throughput of the running PostgreSQL server.
+# Backups go to a separate WALG_S3_PREFIX, which is deleted afterwards.
+set -eo pipefail
+export PGPASSWORD=$(cat "$POSTGRES_PASSWORD_FILE")
+
+case "$WALG_S3_PREFIX" in
+  */benchmark) ;;
+  *) echo "WALG_S3_PREFIX must end with /benchmark, not the production prefix" >&2; exit 1 ;;
+esac
+
+# (Optional) Test data in a throwaway database, dropped afterwards
+if [ -n "$PGBENCH_SCALE" ]; then
+  echo "Generating test data (pgbench scale $PGBENCH_SCALE) in database pgbench_benchmark..."
+  createdb pgbench_benchmark
+  trap 'dropdb --if-exists pgbench_benchmark' EXIT
+  pgbench -i -q -s "$PGBENCH_SCALE" pgbench_benchmark
+fi
+
+size_mb=$(( $(du -sk "$PGDATA" | cut -f1) / 1024 ))
+echo "Data directory: ${size_mb}MB"
+
+start=$(date +%s)
+WALG_DELTA_MAX_STEPS=0 wal-g backup-push "$PGDATA" 2> /dev/null
+seconds=$(( $(date +%s) - start )); [ "$seconds" -gt 0 ] || seconds=1
+echo "Full backup: ${seconds}s, $((size_mb / seconds)) MB/s"
+
+start=$(date +%s)
+wal-g backup-fetch /tmp/restore LATEST 2> /dev/null
+seconds=$(( $(date +%s) - start )); [ "$seconds" -gt 0 ] || seconds=1
+echo "Restore (fetch): ${seconds}s, $((size_mb / seconds)) MB/s"
+rm -rf /tmp/restore
+
+wal-g delete everything FORCE --confirm > /dev/null 2>&1
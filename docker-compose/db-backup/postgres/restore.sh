@@ -0,0 +1,21 @@
+#!/bin/bash
+# Restores the latest backup (or BACKUP_NAME) into an empty PGDATA.
+# Set RECOVERY_TARGET_TIME (e.g. "2024-06-30 12:00:00+00") for point-in-time recovery,
+# PostgreSQL replays the archived WAL up to that time on startup.
+set -e
+
+if [ -n "$(ls -A "$PGDATA" 2>/dev/null)" ]; then
+  echo "$PGDATA is not empty, stop PostgreSQL and clear the data volume first." >&2
+  exit 1
+fi
+
+start=$(date +%s)
+wal-g backup-fetch "$PGDATA" "${BACKUP_NAME:-LATEST}"
+echo "Backup fetched in $(( $(date +%s) - start ))s"
+
+echo "restore_command = 'wal-g wal-fetch %f %p'" >> "$PGDATA/postgresql.auto.conf"
+if [ -n "$RECOVERY_TARGET_TIME" ]; then
+  echo "recovery_target_time = '$RECOVERY_TARGET_TIME'" >> "$PGDATA/postgresql.auto.conf"
+  echo "recovery_target_action = 'promote'" >> "$PGDATA/postgresql.auto.conf"
+fi
+touch "$PGDATA/recovery.signal"
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Synthetic dataset of the duplicati and restic benchmarks: <directory> <size in GB>
+# Half random (incompressible) 1MB files, half base64-encoded random (compressible,
+# but every block is distinct, so deduplication doesn't hide the compression cost).
+set -e
+
+DATA=$1
+half=$(($2 * 512))
+rm -rf "$DATA"
+mkdir -p "$DATA"
+
+echo "Generating ${2}GB of test data in $DATA..."
+for i in $(seq 1 "$half"); do
+  head -c 1048576 /dev/urandom > "$DATA/random-$i.bin"
+  head -c 786432 /dev/urandom | base64 | head -c 1048576 > "$DATA/text-$i.txt"
+done
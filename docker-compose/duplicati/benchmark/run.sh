@@ -0,0 +1,34 @@
+#!/bin/bash
+set -e
+
+CLI=$(command -v duplicati-cli || echo "mono /app/duplicati/Duplicati.CommandLine.exe")
+DATA=/data/source
+TARGET=/data/target
+rm -rf "$TARGET" /data/benchmark.sqlite
+mkdir -p "$TARGET"
+
+sh /benchmark/generate.sh "$DATA" "$BENCH_SIZE_GB"
+
+run() {
+  start=$(date +%s)
+  $CLI backup "file://$TARGET" "$DATA" \
+    --no-encryption=true \
+    --dbpath=/data/benchmark.sqlite \
+    --blocksize="$DUPLICATI_BLOCKSIZE" \
+    --dblock-size="$DUPLICATI_DBLOCK_SIZE" \
+    --concurrency-block-hashers="$DUPLICATI_CONCURRENCY_BLOCK_HASHERS" \
+    --concurrency-compressors="$DUPLICATI_CONCURRENCY_COMPRESSORS" \
+    --asynchronous-concurrent-upload-limit="$DUPLICATI_UPLOAD_LIMIT" \
+    --zip-compression-level="$DUPLICATI_COMPRESSION_LEVEL" \
+    --use-block-cache="$DUPLICATI_USE_BLOCK_CACHE" \
+    --tempdir="$DUPLICATI_TEMPDIR" \
+    --console-log-level=Warning > /dev/null
+  seconds=$(( $(date +%s) - start ))
+  [ "$seconds" -gt 0 ] || seconds=1
+  echo "$1: ${seconds}s, $((BENCH_SIZE_GB * 1024 / seconds)) MB/s"
+}
+
+run "Full backup"
+# Second run without changes measures the scan and deduplication overhead
+run "Incremental backup (no changes)"
+echo "Target size: $(du -sh "$TARGET" | cut -f1)"
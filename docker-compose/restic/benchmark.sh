@@ -0,0 +1,33 @@
+#!/bin/sh
+# Backs up a synthetic dataset to a local repository and reports the throughput,
+# then backs up a copy with 5% changed files as a second host to show the deduplication.
+set -e
+
+DATA=/data/source
+rm -rf /data/repository /data/cache
+
+# Same dataset as the duplicati benchmark
+sh /generate.sh "$DATA" "$BENCH_SIZE_GB"
+half=$((BENCH_SIZE_GB * 512))
+
+restic init > /dev/null
+
+run() {
+  start=$(date +%s)
+  restic backup "$DATA" --host "$2" --read-concurrency 4 --pack-size 64 --compression auto --quiet
+  seconds=$(( $(date +%s) - start ))
+  [ "$seconds" -gt 0 ] || seconds=1
+  echo "$1: ${seconds}s, $((BENCH_SIZE_GB * 1024 / seconds)) MB/s"
+}
+
+run "Full backup" host1
+run "Incremental backup (no changes)" host1
+
+# Second host with 5% different files
+for i in $(seq 1 $((half / 10))); do
+  head -c 1048576 /dev/urandom > "$DATA/random-$i.bin"
+done
+run "Similar host (5% changed)" host2
+
+restic stats --mode raw-data | grep -E "Total (Blob|Uncompressed|Size)|Compression"
+echo "Repository size: $(du -sh /data/repository | cut -f1)"
@@ -0,0 +1,44 @@
+# (Optional) Scale the deployment on CPU utilization
+resource "kubernetes_horizontal_pod_autoscaler_v2" "your-deployment" {
+
+    depends_on = [kubernetes_deployment.your-deployment]
+
+    metadata {
+        name = "your-deployment"
+        namespace = "your-namespace"
+    }
+
+    spec {
+        min_replicas = 2
+        max_replicas = 10
+
+        scale_target_ref {
+            api_version = "apps/v1"
+            kind = "Deployment"
+            name = "your-deployment"
+        }
+
+        metric {
+            type = "Resource"
+            resource {
+                name = "cpu"
+                target {
+                    type = "Utilization"
+                    average_utilization = 70
+                }
+            }
+        }
+
+        behavior {
+            scale_down {
+                stabilization_window_seconds = 300
+                select_policy = "Max"
+                policy {
+                    type = "Pods"
+                    value = 1
+                    period_seconds = 60
+                }
+            }
+        }
+    }
+}
@@ -11,7 +11,8 @@ resource "kubernetes_deployment" "your-deployment" {
     }
 
     spec {
-        replicas = 1
+        # Managed by the HorizontalPodAutoscaler in "autoscaler.tf"
+        replicas = 2
 
         selector {
             match_labels = {
@@ -19,6 +20,15 @@ resource "kubernetes_deployment" "your-deployment" {
             }
         }
 
+        # Start new pods before old ones are removed
+        strategy {
+            type = "RollingUpdate"
+            rolling_update {
+                max_surge = "25%"
+                max_unavailable = "0"
+            }
+        }
+
         template {
             metadata {
                 labels = {
@@ -27,15 +37,101 @@ resource "kubernetes_deployment" "your-deployment" {
             }
 
             spec {
+                # Must be longer than the preStop sleep plus your shutdown time
+                termination_grace_period_seconds = 30
+
+                topology_spread_constraint {
+                    max_skew = 1
+                    topology_key = "kubernetes.io/hostname"
+                    when_unsatisfiable = "ScheduleAnyway"
+                    label_selector {
+                        match_labels = {
+                            app = "your-app-selector"
+                        }
+                    }
+                }
+
                 container {
-                    image = "your-image:latest"
+                    image = "your-image:1.0.0"
                     name  = "your-container"
 
                     port {
+                        name = "http"
                         container_port = 80
                     }
+
+                    resources {
+                        requests = {
+                            cpu    = "200m"
+                            memory = "256Mi"
+                        }
+                        limits = {
+                            cpu    = "1"
+                            memory = "512Mi"
+                        }
+                    }
+
+                    startup_probe {
+                        http_get {
+                            path = "/healthz"
+                            port = "http"
+                        }
+                        period_seconds = 5
+                        failure_threshold = 30
+                    }
+
+                    readiness_probe {
+                        http_get {
+                            path = "/ready"
+                            port = "http"
+                        }
+                        period_seconds = 5
+                        failure_threshold = 3
+                    }
+
+                    liveness_probe {
+                        http_get {
+                            path = "/healthz"
+                            port = "http"
+                        }
+                        period_seconds = 10
+                        failure_threshold = 3
+                    }
+
+                    # Keep serving until the endpoint removal has propagated
+                    lifecycle {
+                        pre_stop {
+                            exec {
+                                command = ["sh", "-c", "sleep 10"]
+                            }
+                        }
+                    }
                 }
             }
         }
     }
+
+    # Don't reset the replicas scaled by the HorizontalPodAutoscaler
+    lifecycle {
+        ignore_changes = [spec[0].replicas]
+    }
+}
+
+resource "kubernetes_pod_disruption_budget_v1" "your-deployment" {
+
+    depends_on = [kubernetes_namespace.your-namespace]
+
+    metadata {
+        name = "your-deployment"
+        namespace = "your-namespace"
+    }
+
+    spec {
+        min_available = 1
+        selector {
+            match_labels = {
+                app = "your-app-selector"
+            }
+        }
+    }
 }